@@ -63,8 +63,25 @@
 #include "driver.h"
 #include "default_modes.h"
 
+// Test a config option, either against the runtime config byte cfg or,
+// with FIXED_CONFIG, against a constant so the compiler can drop dead branches
+// (cfg is ignored in that case)
+#ifdef FIXED_CONFIG
+#if !((FIXED_CONFIG) & CONFIG_SET)
+#error "FIXED_CONFIG must include CONFIG_SET, the runtime build would reset it to CONFIG_DEFAULT"
+#endif
+#ifdef TEMP_CAL_MODE
+#error "TEMP_CAL_MODE needs config mode to calibrate, it can't be used with FIXED_CONFIG"
+#endif
+#define CONFIG_ON(cfg, opt) ((FIXED_CONFIG) & (opt))
+#else
+#define CONFIG_ON(cfg, opt) ((cfg) & (opt))
+#endif
+
 // Volatile globals
+#ifndef FIXED_CONFIG
 uint8_t fast_presses __attribute__ ((section (".noinit"))); // counter for entering config mode
+#endif
 uint8_t locked_in  __attribute__ ((section (".noinit")));   // LOCK_MODE variable
 
 // Constant globals
@@ -104,7 +121,7 @@ inline void EEPROM_erase(uint8_t address) {
 
 inline uint8_t reverse_idx(uint8_t config, uint8_t mode_idx) {
 	// Reverse the index if the config option is set and the index is in normal modes 
-	if ((config & MODE_DIR) && (mode_idx < NUM_MODES) && !(config & MUGGLE)) {
+	if (CONFIG_ON(config, MODE_DIR) && (mode_idx < NUM_MODES) && !CONFIG_ON(config, MUGGLE)) {
 		mode_idx = (NUM_MODES - 1 - mode_idx);
 	}
 	return mode_idx;
@@ -135,9 +152,11 @@ inline uint8_t restore_maxtemp(){
 }
 #endif
 
+#ifndef FIXED_CONFIG
 void save_config(uint8_t config) {
 	EEPROM_write(EEPLEN, ~config); // Config is stationary
 }
+#endif
 
 inline void ADC_on(uint8_t dpin, uint8_t channel) {
 	DIDR0 |= (1 << dpin);                             // Disable digital input on analog channel by setting the DIDR0 (Digital Input Disable Register) bit in the position for that pin
@@ -209,7 +228,7 @@ uint8_t get_temperature() {
 #endif
 
 inline void set_lock(uint8_t config) {
-	if (config & LOCK_MODE) {
+	if (CONFIG_ON(config, LOCK_MODE)) {
 		_delay_10_ms(255); // Delay for 2.55 seconds
 		locked_in = 1;     // Lock the output
 	}
@@ -240,7 +259,7 @@ uint8_t get_bat() {
 inline uint8_t med_press(uint8_t mode_idx, uint8_t config, uint8_t i) {
 	if (mode_idx >= MODE_CNT) { // Loop back if we've hit the end of hidden modes
 		mode_idx = 0;
-	} else if ((mode_idx == 0) || ((config & MOON_MODE) && (mode_idx == i))) { // If we're at mode_idx 0, go to hidden modes
+	} else if ((mode_idx == 0) || (CONFIG_ON(config, MOON_MODE) && (mode_idx == i))) { // If we're at mode_idx 0, go to hidden modes
 		mode_idx = NUM_MODES;
 	} else if (mode_idx < NUM_MODES) { // Walk backwards if we're in normal modes
 		mode_idx -= i;
@@ -253,7 +272,7 @@ inline uint8_t med_press(uint8_t mode_idx, uint8_t config, uint8_t i) {
 inline uint8_t next(uint8_t mode_idx, uint8_t config, uint8_t i) {
 	mode_idx += i;        // Start out by just incrementing the mode
 	
-	if ((mode_idx >= NUM_MODES) || ((config & MUGGLE) && (mode_idx > (NUM_MODES - 3)))) {
+	if ((mode_idx >= NUM_MODES) || (CONFIG_ON(config, MUGGLE) && (mode_idx > (NUM_MODES - 3)))) {
 		mode_idx = 0; // If we're at or above the brightest mode, or we're in muggle mode
 		              // and we're above the third-highest mode, drop to the lowest brightness
 	}
@@ -296,6 +315,9 @@ int main(void) {
 	// Keep track of the eeprom position
 	uint8_t eepos = 0;
 
+#ifdef FIXED_CONFIG
+	const uint8_t config = FIXED_CONFIG;
+#else
 	// Read config values
 	uint8_t config = ~EEPROM_read(EEPLEN);
 
@@ -305,10 +327,11 @@ int main(void) {
 		config = CONFIG_DEFAULT;
 		save_config(config);
 	}
+#endif
 
 	// First, get the "mode group" (increment value)
 	uint8_t i = MODE1INC; // This is reused a lot, it's set to 2 for mode group 2 step augmentation
-	if (config & MODE_GROUP) {
+	if (CONFIG_ON(config, MODE_GROUP)) {
 		i = MODE2INC;
 	}
 
@@ -324,27 +347,31 @@ int main(void) {
 	}
 
 	// Manipulate index depending on config options
-	if (cap_val < CAP_MED || (cap_val < CAP_SHORT && !(config & MED_PRESS))) {
+	if (cap_val < CAP_MED || (cap_val < CAP_SHORT && !CONFIG_ON(config, MED_PRESS))) {
+#ifndef FIXED_CONFIG
 		// Long press, clear fast_presses
 		fast_presses = 0;
+#endif
 		// Reset to the first mode if memory isn't set on
-		if (!(config & MEMORY)) {
+		if (!CONFIG_ON(config, MEMORY)) {
 			mode_idx = 0;
 		}
 		locked_in = 0;
-	} else if (locked_in && (config & LOCK_MODE)) {
+	} else if (locked_in && CONFIG_ON(config, LOCK_MODE)) {
 		// Do nothing
-	} else if ((cap_val < CAP_SHORT) && !(config & MUGGLE)) {
+	} else if ((cap_val < CAP_SHORT) && !CONFIG_ON(config, MUGGLE)) {
 		// User did a medium press
 		mode_idx = med_press(mode_idx, config, i);
 	} else {
+#ifndef FIXED_CONFIG
 		// We don't care what the value is as long as it's over 15
 		fast_presses = (fast_presses+1) & 0x1f;
+#endif
 		// Indicates they did a short press, go to the next mode
 		mode_idx = next(mode_idx, config, i);
 	}
 	
-	if ((config & MOON_MODE) && !mode_idx) { // If moon mode is on and the index is 0, increment the mode once to disable moon mode
+	if (CONFIG_ON(config, MOON_MODE) && !mode_idx) { // If moon mode is on and the index is 0, increment the mode once to disable moon mode
 		mode_idx += i;
 	}
 
@@ -382,6 +409,7 @@ int main(void) {
 			eepos = save_mode_idx(mode_idx, config, eepos);
 		}
 		
+#ifndef FIXED_CONFIG
 		// Config mode
 		if (fast_presses > 0x0f) {  
 			_delay_s();	      // wait for user to stop fast-pressing button
@@ -432,6 +460,7 @@ int main(void) {
 			}
 #endif
 		}
+#endif
 
 		uint8_t output = modesNx[mode_idx];
 		switch (output) {
@@ -477,9 +506,11 @@ int main(void) {
 				_delay_s();
 				break;
 		}
+		ticks++;
+#ifndef FIXED_CONFIG
 		// If we got this far, the user has stopped fast-pressing.
 		// So, don't enter config mode.
-		ticks++;
 		fast_presses = 0;
+#endif
 	}
 }
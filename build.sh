@@ -1,12 +1,18 @@
 #!/usr/bin/env bash
 
 # This is a simple script to build a firmware and extract the ihex.
+# Any extra arguments are passed to avr-gcc, e.g. -D FIXED_CONFIG=...
 
 iname=$1
 mcu=$2
 oname="${iname}-${mcu}"
 
+# Keep fixed config builds from overwriting the stock images
+if [[ "${*:3}" == *FIXED_CONFIG* ]] || grep -q '^#define FIXED_CONFIG' default_modes.h; then
+	oname="${iname}-fixed-${mcu}"
+fi
+
 mcuvar=$(echo ${mcu} | egrep -o '[0-9]{1,3}')
 
-avr-gcc -Wall -Os -mmcu=${mcu} -D ATTINY=${mcuvar} -o ${oname}.elf ${iname}.c && avr-size -C ${oname}.elf
+avr-gcc -Wall -Os -mmcu=${mcu} -D ATTINY=${mcuvar} "${@:3}" -o ${oname}.elf ${iname}.c && avr-size -C ${oname}.elf
 avr-objcopy -j .text -j .data -O ihex ${oname}.elf ${oname}.hex
@@ -63,3 +63,10 @@ const uint8_t modes1x[] = { MODES1x1, HIDDENMODES_ALT };
 // or when the config is wiped
 #define CONFIG_DEFAULT (CONFIG_SET + MODE_GROUP) // 4 modes default
 
+// Uncomment (or pass -D FIXED_CONFIG=... to the build script) to bake the
+// config into the firmware.  The config is never read from or written to
+// EEPROM, config mode is removed, and all the option checks are resolved at
+// compile time.  Must include CONFIG_SET, and can't be combined with
+// TEMP_CAL_MODE since calibration is only reachable from config mode.
+//#define FIXED_CONFIG CONFIG_DEFAULT
+